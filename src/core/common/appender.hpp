@@ -0,0 +1,790 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for `Appender` class which helps appending bytes to a `Message` or a data buffer.
+ */
+
+#ifndef APPENDER_HPP_
+#define APPENDER_HPP_
+
+#include "openthread-core-config.h"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/error.hpp"
+#include "common/message.hpp"
+#include "common/new.hpp"
+#include "common/non_copyable.hpp"
+#include "common/numeric_limits.hpp"
+#include "common/type_traits.hpp"
+
+namespace ot {
+
+/**
+ * This class appends bytes to a given data buffer.
+ *
+ * This class can be used directly by call sites that always append to a data buffer (avoiding the runtime type
+ * dispatch in `Appender`).
+ *
+ */
+class BufferAppender
+{
+public:
+    /**
+     * This constructor initializes the `BufferAppender` to append in a given data buffer.
+     *
+     * New content is appended in the buffer starting from @p aBuffer up to its size @p aSize. `BufferAppender` does
+     * not allow content to be appended beyond the size of the buffer.
+     *
+     * @param[in] aBuffer  A pointer to start of buffer.
+     * @param[in] aSize    The maximum size of @p aBuffer (number of available bytes in buffer).
+     *
+     */
+    BufferAppender(uint8_t *aBuffer, uint16_t aSize)
+        : mCur(aBuffer)
+        , mRemaining(aSize)
+        , mAppendedLength(0)
+    {
+    }
+
+    /**
+     * This method appends bytes to the buffer.
+     *
+     * @param[in] aBuffer  A pointer to a data buffer (MUST NOT be `nullptr`) to append.
+     * @param[in] aLength  The number of bytes to append.
+     *
+     * @retval kErrorNone    Successfully appended the bytes.
+     * @retval kErrorNoBufs  Insufficient available space in the buffer.
+     *
+     */
+    Error AppendBytes(const void *aBuffer, uint16_t aLength)
+    {
+        Error error = kErrorNone;
+
+        VerifyOrExit(CanAppend(aLength), error = kErrorNoBufs);
+        memcpy(mCur, aBuffer, aLength);
+        Advance(aLength);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method appends an object to the buffer.
+     *
+     * Since the object size is known at compile time, the compiler can lower the `memcpy()` to direct stores for
+     * small objects.
+     *
+     * @tparam    ObjectType   The object type to append.
+     *
+     * @param[in] aObject      A reference to the object to append.
+     *
+     * @retval kErrorNone    Successfully appended the object.
+     * @retval kErrorNoBufs  Insufficient available space in the buffer.
+     *
+     */
+    template <typename ObjectType> Error Append(const ObjectType &aObject)
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
+
+        return AppendBytes(&aObject, sizeof(ObjectType));
+    }
+
+    /**
+     * This method appends an array of objects to the buffer.
+     *
+     * The entire array content is appended with a single bounds check and copy rather than one per element.
+     *
+     * @tparam    ObjectType   The object type of the array items.
+     *
+     * @param[in] aItems       A pointer to the array of objects to append.
+     * @param[in] aNumItems    The number of items in the array.
+     *
+     * @retval kErrorNone    Successfully appended all the items.
+     * @retval kErrorNoBufs  Insufficient available space in the buffer.
+     *
+     */
+    template <typename ObjectType> Error AppendItems(const ObjectType *aItems, uint16_t aNumItems)
+    {
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
+
+        uint32_t totalLength = static_cast<uint32_t>(aNumItems) * sizeof(ObjectType);
+
+        return (totalLength > NumericLimits<uint16_t>::Max()) ? kErrorNoBufs
+                                                              : AppendBytes(aItems, static_cast<uint16_t>(totalLength));
+    }
+
+    /**
+     * This method appends bytes read from a given message to the buffer.
+     *
+     * The bytes are read directly into the destination buffer with no intermediate staging copy.
+     *
+     * @param[in] aMessage   The message to read the bytes from.
+     * @param[in] aOffset    The offset in @p aMessage to start reading the bytes from.
+     * @param[in] aLength    The number of bytes to read from @p aMessage and append.
+     *
+     * @retval kErrorNone    Successfully appended the bytes.
+     * @retval kErrorNoBufs  Insufficient available space in the buffer.
+     * @retval kErrorParse   Not enough bytes in @p aMessage to read @p aLength bytes from @p aOffset.
+     *
+     */
+    Error AppendBytesFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+    {
+        Error error = kErrorNone;
+
+        VerifyOrExit(CanAppend(aLength), error = kErrorNoBufs);
+        VerifyOrExit(aMessage.ReadBytes(aOffset, mCur, aLength) == aLength, error = kErrorParse);
+        Advance(aLength);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method reserves a range of bytes in the buffer and returns a pointer to the start of the reserved range.
+     *
+     * The reserved range is accounted for as appended content and the caller is expected to directly fill all the
+     * @p aLength reserved bytes. This allows a variable-length field to be serialized straight into its final
+     * destination instead of being built in a separate buffer and then copied in with `AppendBytes()`.
+     *
+     * @param[in]  aLength  The number of bytes to reserve.
+     * @param[out] aBuffer  A reference to a pointer to output the start of the reserved range on success.
+     *
+     * @retval kErrorNone    Successfully reserved the bytes.
+     * @retval kErrorNoBufs  Insufficient available space in the buffer.
+     *
+     */
+    Error ReserveBytes(uint16_t aLength, uint8_t *&aBuffer)
+    {
+        Error error = kErrorNone;
+
+        VerifyOrExit(CanAppend(aLength), error = kErrorNoBufs);
+        aBuffer = mCur;
+        Advance(aLength);
+
+    exit:
+        return error;
+    }
+
+    /**
+     * This method writes bytes over the already appended content in the buffer.
+     *
+     * This method does not perform any bound checks. The caller MUST have already appended the range being written,
+     * e.g., patching a length field after the content it covers is appended.
+     *
+     * @param[in] aOffset   The offset to begin writing, relative to the start of the appended content.
+     * @param[in] aBuffer   A pointer to a data buffer to write.
+     * @param[in] aLength   The number of bytes to write.
+     *
+     */
+    void WriteBytes(uint16_t aOffset, const void *aBuffer, uint16_t aLength)
+    {
+        memcpy(GetBufferStart() + aOffset, aBuffer, aLength);
+    }
+
+    /**
+     * This method writes an object over the already appended content in the buffer.
+     *
+     * This method does not perform any bound checks. The caller MUST have already appended the range being written.
+     *
+     * @tparam    ObjectType   The object type to write.
+     *
+     * @param[in] aOffset   The offset to begin writing, relative to the start of the appended content.
+     * @param[in] aObject   A reference to the object to write.
+     *
+     */
+    template <typename ObjectType> void Write(uint16_t aOffset, const ObjectType &aObject)
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
+
+        WriteBytes(aOffset, &aObject, sizeof(ObjectType));
+    }
+
+    /**
+     * This method returns the number of bytes appended so far.
+     *
+     * @returns The number of bytes appended so far.
+     *
+     */
+    uint16_t GetAppendedLength(void) const { return mAppendedLength; }
+
+    /**
+     * This method returns a pointer to the start of the data buffer.
+     *
+     * @returns A pointer to the start of the data buffer.
+     *
+     */
+    uint8_t *GetBufferStart(void) const { return mCur - mAppendedLength; }
+
+    /**
+     * This method indicates whether or not a given number of bytes can be appended in the remaining buffer space.
+     *
+     * The check is a single unsigned comparison against the tracked remaining space (no pointer subtraction is
+     * needed on the append path).
+     *
+     * @param[in] aLength   The append length to check.
+     *
+     * @retval TRUE   There is enough buffer space to append @p aLength bytes.
+     * @retval FALSE  There is not enough buffer space to append @p aLength bytes.
+     *
+     */
+    bool CanAppend(uint16_t aLength) const { return aLength <= mRemaining; }
+
+    /**
+     * This class provides a scoped cursor to perform a burst of appends to a `BufferAppender`.
+     *
+     * The cursor caches the buffer write position in its own (stack-local) variables on construction and writes the
+     * final position back to the `BufferAppender` on destruction. This allows the compiler to keep the cursor in
+     * registers across a sequence of appends, since it cannot otherwise prove that the appended bytes do not alias
+     * the `BufferAppender` members themselves.
+     *
+     * While a `Cursor` is active, the associated `BufferAppender` MUST NOT be used directly.
+     *
+     */
+    class Cursor : private NonCopyable
+    {
+    public:
+        /**
+         * This constructor initializes the `Cursor` from a given `BufferAppender`.
+         *
+         * @param[in] aAppender   The `BufferAppender` to append to.
+         *
+         */
+        explicit Cursor(BufferAppender &aAppender)
+            : mAppender(aAppender)
+            , mCur(aAppender.mCur)
+            , mRemaining(aAppender.mRemaining)
+        {
+        }
+
+        /**
+         * This destructor writes the final write position back to the associated `BufferAppender`.
+         *
+         */
+        ~Cursor(void)
+        {
+            mAppender.mAppendedLength += static_cast<uint16_t>(mCur - mAppender.mCur);
+            mAppender.mCur       = mCur;
+            mAppender.mRemaining = mRemaining;
+        }
+
+        /**
+         * This method appends bytes at the cursor position.
+         *
+         * @param[in] aBuffer  A pointer to a data buffer (MUST NOT be `nullptr`) to append.
+         * @param[in] aLength  The number of bytes to append.
+         *
+         * @retval kErrorNone    Successfully appended the bytes.
+         * @retval kErrorNoBufs  Insufficient available space in the buffer.
+         *
+         */
+        Error AppendBytes(const void *aBuffer, uint16_t aLength)
+        {
+            Error error = kErrorNone;
+
+            VerifyOrExit(aLength <= mRemaining, error = kErrorNoBufs);
+            memcpy(mCur, aBuffer, aLength);
+            mCur += aLength;
+            mRemaining -= aLength;
+
+        exit:
+            return error;
+        }
+
+        /**
+         * This method appends an object at the cursor position.
+         *
+         * @tparam    ObjectType   The object type to append.
+         *
+         * @param[in] aObject      A reference to the object to append.
+         *
+         * @retval kErrorNone    Successfully appended the object.
+         * @retval kErrorNoBufs  Insufficient available space in the buffer.
+         *
+         */
+        template <typename ObjectType> Error Append(const ObjectType &aObject)
+        {
+            static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+            static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue,
+                          "ObjectType must be trivially copyable");
+
+            return AppendBytes(&aObject, sizeof(ObjectType));
+        }
+
+    private:
+        BufferAppender &mAppender;
+        uint8_t *       mCur;
+        uint16_t        mRemaining;
+    };
+
+private:
+    void Advance(uint16_t aLength)
+    {
+        mCur += aLength;
+        mRemaining -= aLength;
+        mAppendedLength += aLength;
+    }
+
+    // The buffer start is not stored; it is derived as `mCur - mAppendedLength` when needed (e.g., in
+    // `GetBufferStart()`), keeping the object to a single pointer and two `uint16_t` fields.
+    uint8_t *mCur;
+    uint16_t mRemaining;
+    uint16_t mAppendedLength;
+};
+
+/**
+ * This class defines a `BufferAppender` with its own fixed-size buffer storage.
+ *
+ * This replaces the common pattern of declaring a stack buffer and a separate `BufferAppender` over it. Since the
+ * buffer is embedded and its size is a compile-time constant, the object does not escape the stack frame and the
+ * compiler can promote the append cursor to registers.
+ *
+ * @tparam SIZE   The size (number of bytes) of the buffer storage.
+ *
+ */
+template <uint16_t SIZE> class FixedBufferAppender : public BufferAppender
+{
+public:
+    enum
+    {
+        kSize = SIZE, ///< Size (number of bytes) of the buffer storage.
+    };
+
+    /**
+     * This constructor initializes the `FixedBufferAppender` object as empty.
+     *
+     */
+    FixedBufferAppender(void)
+        : BufferAppender(mBuffer, kSize)
+    {
+    }
+
+private:
+    uint8_t mBuffer[kSize];
+};
+
+/**
+ * This class appends bytes to the end of a given `Message`.
+ *
+ * This class can be used directly by call sites that always append to a `Message` (avoiding the runtime type
+ * dispatch in `Appender`).
+ *
+ */
+class MessageAppender
+{
+public:
+    /**
+     * This constructor initializes the `MessageAppender` to append to a given `Message`.
+     *
+     * New content is appended to the end of @p aMessage, growing its length.
+     *
+     * @param[in] aMessage   The message to append to.
+     *
+     */
+    explicit MessageAppender(Message &aMessage)
+        : mMessage(&aMessage)
+        , mStartOffset(aMessage.GetLength())
+    {
+    }
+
+    /**
+     * This method appends bytes to the message.
+     *
+     * @param[in] aBuffer  A pointer to a data buffer (MUST NOT be `nullptr`) to append.
+     * @param[in] aLength  The number of bytes to append.
+     *
+     * @retval kErrorNone    Successfully appended the bytes.
+     * @retval kErrorNoBufs  Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendBytes(const void *aBuffer, uint16_t aLength) { return mMessage->AppendBytes(aBuffer, aLength); }
+
+    /**
+     * This method appends an object to the message.
+     *
+     * @tparam    ObjectType   The object type to append.
+     *
+     * @param[in] aObject      A reference to the object to append.
+     *
+     * @retval kErrorNone    Successfully appended the object.
+     * @retval kErrorNoBufs  Insufficient available buffers to grow the message.
+     *
+     */
+    template <typename ObjectType> Error Append(const ObjectType &aObject) { return mMessage->Append(aObject); }
+
+    /**
+     * This method appends an array of objects to the message.
+     *
+     * The entire array content is appended with a single bounds check and copy rather than one per element.
+     *
+     * @tparam    ObjectType   The object type of the array items.
+     *
+     * @param[in] aItems       A pointer to the array of objects to append.
+     * @param[in] aNumItems    The number of items in the array.
+     *
+     * @retval kErrorNone    Successfully appended all the items.
+     * @retval kErrorNoBufs  Insufficient available buffers to grow the message.
+     *
+     */
+    template <typename ObjectType> Error AppendItems(const ObjectType *aItems, uint16_t aNumItems)
+    {
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
+
+        uint32_t totalLength = static_cast<uint32_t>(aNumItems) * sizeof(ObjectType);
+
+        return (totalLength > NumericLimits<uint16_t>::Max()) ? kErrorNoBufs
+                                                              : AppendBytes(aItems, static_cast<uint16_t>(totalLength));
+    }
+
+    /**
+     * This method appends bytes read from another or potentially the same message to the message.
+     *
+     * @param[in] aMessage   The message to read the bytes from (it can be the same as the current message).
+     * @param[in] aOffset    The offset in @p aMessage to start reading the bytes from.
+     * @param[in] aLength    The number of bytes to read from @p aMessage and append.
+     *
+     * @retval kErrorNone    Successfully appended the bytes.
+     * @retval kErrorNoBufs  Insufficient available buffers to grow the message.
+     * @retval kErrorParse   Not enough bytes in @p aMessage to read @p aLength bytes from @p aOffset.
+     *
+     */
+    Error AppendBytesFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
+    {
+        return mMessage->AppendBytesFromMessage(aMessage, aOffset, aLength);
+    }
+
+    /**
+     * This method writes bytes over the already appended content in the message.
+     *
+     * This method does not perform any bound checks. The caller MUST have already appended the range being written.
+     *
+     * @param[in] aOffset   The offset to begin writing, relative to the start of the appended content.
+     * @param[in] aBuffer   A pointer to a data buffer to write.
+     * @param[in] aLength   The number of bytes to write.
+     *
+     */
+    void WriteBytes(uint16_t aOffset, const void *aBuffer, uint16_t aLength)
+    {
+        mMessage->WriteBytes(mStartOffset + aOffset, aBuffer, aLength);
+    }
+
+    /**
+     * This method writes an object over the already appended content in the message.
+     *
+     * This method does not perform any bound checks. The caller MUST have already appended the range being written.
+     *
+     * @tparam    ObjectType   The object type to write.
+     *
+     * @param[in] aOffset   The offset to begin writing, relative to the start of the appended content.
+     * @param[in] aObject   A reference to the object to write.
+     *
+     */
+    template <typename ObjectType> void Write(uint16_t aOffset, const ObjectType &aObject)
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
+
+        WriteBytes(aOffset, &aObject, sizeof(ObjectType));
+    }
+
+    /**
+     * This method returns the number of bytes appended so far.
+     *
+     * @returns The number of bytes appended so far.
+     *
+     */
+    uint16_t GetAppendedLength(void) const { return mMessage->GetLength() - mStartOffset; }
+
+    /**
+     * This method returns the `Message` associated with `MessageAppender`.
+     *
+     * @returns The `Message` instance associated with `MessageAppender`.
+     *
+     */
+    Message &GetMessage(void) const { return *mMessage; }
+
+private:
+    Message *mMessage;
+    uint16_t mStartOffset;
+};
+
+/**
+ * This class acts as a wrapper over either a `Message` or a data buffer and provides different methods to append
+ * bytes to the `Message` or data buffer.
+ *
+ * This class is intended for the few call sites that need to handle both flavors with a common type. Call sites that
+ * statically know which flavor they append to should use `MessageAppender` or `BufferAppender` directly, which avoids
+ * the runtime type dispatch.
+ *
+ */
+class Appender
+{
+public:
+    /**
+     * This enumeration represents the `Appender` type (whether appending to a `Message` or data buffer).
+     *
+     */
+    enum Type : uint8_t
+    {
+        kMessage, ///< `Appender` appends to a `Message`
+        kBuffer,  ///< `Appender` appends to a data buffer.
+    };
+
+    /**
+     * This constructor initializes the `Appender` to append to a `Message`.
+     *
+     * New content is appended to the end of @p aMessage, growing its length.
+     *
+     * @param[in] aMessage   The message to append to.
+     *
+     */
+    explicit Appender(Message &aMessage)
+        : mType(kMessage)
+    {
+        new (&mShared.mMessageAppender) MessageAppender(aMessage);
+    }
+
+    /**
+     * This constructor initializes the `Appender` to append in a given data buffer.
+     *
+     * New content is append in the buffer starting from @p aBuffer up to is size @p aSize. `Appender` does not allow
+     * content to be appended beyond the size of the buffer.
+     *
+     * @param[in] aBuffer  A pointer to start of buffer.
+     * @param[in] aSize    The maximum size of @p aBuffer (number of available bytes in buffer).
+     *
+     */
+    Appender(uint8_t *aBuffer, uint16_t aSize)
+        : mType(kBuffer)
+    {
+        new (&mShared.mBufferAppender) BufferAppender(aBuffer, aSize);
+    }
+
+    /**
+     * This method indicates the `Appender` type (whether appending to a `Message` or data buffer).
+     *
+     * @returns The type of `Appender`.
+     *
+     */
+    Type GetType(void) const { return mType; }
+
+    /**
+     * This method appends bytes to the `Appender` object
+     *
+     * @param[in] aBuffer  A pointer to a data buffer (MUST NOT be `nullptr`) to append.
+     * @param[in] aLength  The number of bytes to append.
+     *
+     * @retval kErrorNone    Successfully appended the bytes.
+     * @retval kErrorNoBufs  Insufficient available buffers.
+     *
+     */
+    Error AppendBytes(const void *aBuffer, uint16_t aLength);
+
+    /**
+     * This method appends bytes read from a given message to the `Appender` object.
+     *
+     * In buffer mode the bytes are read directly into the destination buffer, and in message mode the chunk-wise
+     * `Message::AppendBytesFromMessage()` is used; neither path stages the bytes through an intermediate buffer.
+     *
+     * @param[in] aMessage   The message to read the bytes from.
+     * @param[in] aOffset    The offset in @p aMessage to start reading the bytes from.
+     * @param[in] aLength    The number of bytes to read from @p aMessage and append.
+     *
+     * @retval kErrorNone    Successfully appended the bytes.
+     * @retval kErrorNoBufs  Insufficient available buffers.
+     * @retval kErrorParse   Not enough bytes in @p aMessage to read @p aLength bytes from @p aOffset.
+     *
+     */
+    Error AppendBytesFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
+
+    /**
+     * This method appends an object to the end of the `Appender` object.
+     *
+     * In buffer mode the append is fully inlined with the object size as a compile-time constant, so the compiler
+     * lowers the `memcpy()` to direct stores (a single store for small objects). This helps TLV and header
+     * construction where multiple small fields are appended back-to-back.
+     *
+     * @tparam    ObjectType   The object type to append to the message.
+     *
+     * @param[in] aObject      A reference to the object to append.
+     *
+     * @retval kErrorNone    Successfully appended the object.
+     * @retval kErrorNoBufs  Insufficient available buffers to append @p aObject.
+     *
+     */
+    template <typename ObjectType> Error Append(const ObjectType &aObject)
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
+
+        return (mType == kBuffer) ? mShared.mBufferAppender.Append(aObject)
+                                  : AppendBytes(&aObject, sizeof(ObjectType));
+    }
+
+    /**
+     * This method appends an array of objects to the `Appender` object.
+     *
+     * The entire array content is appended with a single bounds check and copy rather than one per element.
+     *
+     * @tparam    ObjectType   The object type of the array items.
+     *
+     * @param[in] aItems       A pointer to the array of objects to append.
+     * @param[in] aNumItems    The number of items in the array.
+     *
+     * @retval kErrorNone    Successfully appended all the items.
+     * @retval kErrorNoBufs  Insufficient available buffers.
+     *
+     */
+    template <typename ObjectType> Error AppendItems(const ObjectType *aItems, uint16_t aNumItems)
+    {
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
+
+        uint32_t totalLength = static_cast<uint32_t>(aNumItems) * sizeof(ObjectType);
+
+        return (totalLength > NumericLimits<uint16_t>::Max()) ? kErrorNoBufs
+                                                              : AppendBytes(aItems, static_cast<uint16_t>(totalLength));
+    }
+
+    /**
+     * This method writes bytes over the already appended content.
+     *
+     * This method does not perform any bound checks. The caller MUST have already appended the range being written.
+     * The buffer-mode path is inlined to a plain `memcpy()` with no type branch left after inlining at call sites
+     * where the type is known.
+     *
+     * @param[in] aOffset   The offset to begin writing, relative to the start of the appended content.
+     * @param[in] aBuffer   A pointer to a data buffer to write.
+     * @param[in] aLength   The number of bytes to write.
+     *
+     */
+    void WriteBytes(uint16_t aOffset, const void *aBuffer, uint16_t aLength)
+    {
+        if (mType == kBuffer)
+        {
+            mShared.mBufferAppender.WriteBytes(aOffset, aBuffer, aLength);
+        }
+        else
+        {
+            mShared.mMessageAppender.WriteBytes(aOffset, aBuffer, aLength);
+        }
+    }
+
+    /**
+     * This method writes an object over the already appended content.
+     *
+     * This method does not perform any bound checks. The caller MUST have already appended the range being written.
+     *
+     * @tparam    ObjectType   The object type to write.
+     *
+     * @param[in] aOffset   The offset to begin writing, relative to the start of the appended content.
+     * @param[in] aObject   A reference to the object to write.
+     *
+     */
+    template <typename ObjectType> void Write(uint16_t aOffset, const ObjectType &aObject)
+    {
+        static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
+
+        WriteBytes(aOffset, &aObject, sizeof(ObjectType));
+    }
+
+    /**
+     * This method returns the number of bytes appended so far using `Appender` methods.
+     *
+     * This method can be used independent of the `Type` of `Appender`.
+     *
+     * @returns The number of bytes appended so far.
+     *
+     */
+    uint16_t GetAppendedLength(void) const
+    {
+        return (mType == kMessage) ? mShared.mMessageAppender.GetAppendedLength()
+                                   : mShared.mBufferAppender.GetAppendedLength();
+    }
+
+    /**
+     * This method returns the `Message` associated with `Appender`.
+     *
+     * This method MUST be used when `GetType() == kMessage`. Otherwise its behavior is undefined.
+     *
+     * @returns The `Message` instance associated with `Appender`.
+     *
+     */
+    Message &GetMessage(void) const { return mShared.mMessageAppender.GetMessage(); }
+
+    /**
+     * This method returns a pointer to the start of the data buffer associated with `Appender`.
+     *
+     * This method MUST be used when `GetType() == kBuffer`. Otherwise its behavior is undefined.
+     *
+     * @returns A pointer to the start of the data buffer associated with `Appender`.
+     *
+     */
+    uint8_t *GetBufferStart(void) const { return mShared.mBufferAppender.GetBufferStart(); }
+
+    /**
+     * This method moves the appended content into a given message.
+     *
+     * When `GetType() == kBuffer` the appended bytes are appended to @p aMessage in a single pass. Note that since
+     * the `Appender` does not own its buffer, the bytes are copied (not handed over). When `GetType() == kMessage`
+     * the content already resides in the associated message and this method does nothing; in this case @p aMessage
+     * MUST be the same message the `Appender` was constructed with.
+     *
+     * @param[in] aMessage   The message to move the appended content into.
+     *
+     * @retval kErrorNone    Successfully moved the content into @p aMessage (or it was already there).
+     * @retval kErrorNoBufs  Insufficient available buffers to grow @p aMessage.
+     *
+     */
+    Error MoveToMessage(Message &aMessage);
+
+private:
+    // The union is placed first so the one-byte tag sits in its tail
+    // padding slot rather than forcing a padded leading slot.
+    union Shared
+    {
+        Shared(void) {}
+
+        MessageAppender mMessageAppender;
+        BufferAppender  mBufferAppender;
+    } mShared;
+
+    Type mType;
+};
+
+static_assert(sizeof(Appender) <= sizeof(BufferAppender) + sizeof(uint8_t *),
+              "Appender is larger than its expected footprint");
+
+} // namespace ot
+
+#endif // APPENDER_HPP_
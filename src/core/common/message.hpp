@@ -632,6 +632,7 @@ public:
     template <typename ObjectType> Error Prepend(const ObjectType &aObject)
     {
         static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
 
         return PrependBytes(&aObject, sizeof(ObjectType));
     }
@@ -690,6 +691,7 @@ public:
     template <typename ObjectType> Error Append(const ObjectType &aObject)
     {
         static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
 
         return AppendBytes(&aObject, sizeof(ObjectType));
     }
@@ -827,6 +829,7 @@ public:
     template <typename ObjectType> void Write(uint16_t aOffset, const ObjectType &aObject)
     {
         static_assert(!TypeTraits::IsPointer<ObjectType>::kValue, "ObjectType must not be a pointer");
+        static_assert(TypeTraits::IsTriviallyCopyable<ObjectType>::kValue, "ObjectType must be trivially copyable");
 
         WriteBytes(aOffset, &aObject, sizeof(ObjectType));
     }
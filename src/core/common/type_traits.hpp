@@ -86,6 +86,20 @@ template <typename Type> struct IsPointer<const volatile Type *> : TrueValue
 {
 };
 
+/**
+ * This type indicates whether or not a given template `Type` is trivially copyable.
+ *
+ * The `constexpr` expression `IsTriviallyCopyable<Type>::kValue` would be `true` when the `Type` is trivially
+ * copyable, otherwise it would be `false`.
+ *
+ * @tparam Type    A type to check if is trivially copyable.
+ *
+ */
+template <typename Type> struct IsTriviallyCopyable
+{
+    constexpr static bool kValue = __is_trivially_copyable(Type); ///< Indicates whether `Type` is trivially copyable.
+};
+
 /**
  * This type indicates whether or not a given template `FirstType is the same as `SecondType`.
  *
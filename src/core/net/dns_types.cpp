@@ -500,6 +500,30 @@ exit:
     return error;
 }
 
+bool Name::LabelIterator::CaselessMatch(const uint8_t *aLabelBytes) const
+{
+    // This method compares the current label in the iterator with the
+    // `aLabelBytes` (which MUST contain at least `mLabelLength` chars)
+    // ignoring ASCII letter case. It is the fallback path used only
+    // after an exact byte compare of the same label has failed, since
+    // registered and queried names nearly always agree in case.
+
+    uint8_t label[kMaxLabelLength];
+    bool    matches = false;
+
+    VerifyOrExit(mMessage.ReadBytes(mLabelStartOffset, label, mLabelLength) == mLabelLength);
+
+    for (uint8_t index = 0; index < mLabelLength; index++)
+    {
+        VerifyOrExit(ToLowercaseChar(label[index]) == ToLowercaseChar(aLabelBytes[index]));
+    }
+
+    matches = true;
+
+exit:
+    return matches;
+}
+
 bool Name::LabelIterator::CompareLabel(const char *&aName, bool aIsSingleLabel) const
 {
     // This method compares the current label in the iterator with the
@@ -513,7 +537,8 @@ bool Name::LabelIterator::CompareLabel(const char *&aName, bool aIsSingleLabel)
     bool matches = false;
 
     VerifyOrExit(StringLength(aName, mLabelLength) == mLabelLength);
-    matches = mMessage.CompareBytes(mLabelStartOffset, aName, mLabelLength);
+    matches = mMessage.CompareBytes(mLabelStartOffset, aName, mLabelLength) ||
+              CaselessMatch(reinterpret_cast<const uint8_t *>(aName));
 
     VerifyOrExit(matches);
 
@@ -540,9 +565,24 @@ bool Name::LabelIterator::CompareLabel(const LabelIterator &aOtherIterator) cons
     // This method compares the current label in the iterator with the
     // label from another iterator.
 
-    return (mLabelLength == aOtherIterator.mLabelLength) &&
-           mMessage.CompareBytes(mLabelStartOffset, aOtherIterator.mMessage, aOtherIterator.mLabelStartOffset,
-                                 mLabelLength);
+    bool matches = false;
+
+    VerifyOrExit(mLabelLength == aOtherIterator.mLabelLength);
+
+    matches = mMessage.CompareBytes(mLabelStartOffset, aOtherIterator.mMessage, aOtherIterator.mLabelStartOffset,
+                                    mLabelLength);
+
+    if (!matches)
+    {
+        uint8_t otherLabel[kMaxLabelLength];
+
+        VerifyOrExit(aOtherIterator.mMessage.ReadBytes(aOtherIterator.mLabelStartOffset, otherLabel, mLabelLength) ==
+                     mLabelLength);
+        matches = CaselessMatch(otherLabel);
+    }
+
+exit:
+    return matches;
 }
 
 bool Name::IsSubDomainOf(const char *aName, const char *aDomain)
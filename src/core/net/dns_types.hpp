@@ -893,6 +893,8 @@ public:
      * The @p aName must follow  "<label1>.<label2>.<label3>", i.e., a sequence of labels separated by dot '.' char.
      * E.g., "example.com", "example.com." (same as previous one), "local.", "default.service.arpa", "." or "" (root).
      *
+     * Name characters are compared case-insensitively (per RFC 1035 section 2.3.3).
+     *
      * @param[in]    aMessage         The message to read the name from and compare with @p aName.
      *                                `aMessage.GetOffset()` MUST point to the start of DNS header (this is used to
      *                                handle compressed names).
@@ -914,8 +916,9 @@ public:
      * This static method parses and compares a full name from a message with a name from another message.
      *
      * This method checks whether the encoded name in @p aMessage matches the name from @p aMessage2. It compares the
-     * names in both messages in place and handles compressed names. Note that this method works correctly even when
-     * the same message instance is used for both @p aMessage and @p aMessage2 (e.g., at different offsets).
+     * names in both messages in place and handles compressed names. Name characters are compared case-insensitively
+     * (per RFC 1035 section 2.3.3). Note that this method works correctly even when the same message instance is used
+     * for both @p aMessage and @p aMessage2 (e.g., at different offsets).
      *
      * Only the name in @p aMessage is fully parsed and checked for parse errors. This method assumes that the name in
      * @p aMessage2 was previously parsed and validated before calling this method (if there is a parse error in
@@ -1016,9 +1019,15 @@ private:
         {
         }
 
+        static uint8_t ToLowercaseChar(uint8_t aChar)
+        {
+            return (('A' <= aChar) && (aChar <= 'Z')) ? static_cast<uint8_t>(aChar + ('a' - 'A')) : aChar;
+        }
+
         bool  IsEndOffsetSet(void) const { return (mNameEndOffset != kUnsetNameEndOffset); }
         Error GetNextLabel(void);
         Error ReadLabel(char *aLabelBuffer, uint8_t &aLabelLength, bool aAllowDotCharInLabel) const;
+        bool  CaselessMatch(const uint8_t *aLabelBytes) const;
         bool  CompareLabel(const char *&aName, bool aIsSingleLabel) const;
         bool  CompareLabel(const LabelIterator &aOtherIterator) const;
 
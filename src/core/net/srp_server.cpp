@@ -1356,6 +1356,13 @@ Error Server::Service::SetTxtData(const uint8_t *aTxtData, uint16_t aTxtDataLeng
     Error    error = kErrorNone;
     uint8_t *txtData;
 
+    if ((mTxtData != nullptr) && (aTxtDataLength == mTxtLength) && (memcmp(mTxtData, aTxtData, aTxtDataLength) == 0))
+    {
+        // The TXT data is unchanged; skip the allocation and copy.
+        mIsDeleted = false;
+        ExitNow();
+    }
+
     txtData = static_cast<uint8_t *>(Instance::HeapCAlloc(1, aTxtDataLength));
     VerifyOrExit(txtData != nullptr, error = kErrorNoBufs);
 
@@ -1374,8 +1381,16 @@ exit:
 
 Error Server::Service::SetTxtDataFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
 {
-    Error    error = kErrorNone;
-    uint8_t *txtData;
+    Error    error   = kErrorNone;
+    uint8_t *txtData = nullptr;
+
+    if ((mTxtData != nullptr) && (aLength == mTxtLength) && aMessage.CompareBytes(aOffset, mTxtData, aLength))
+    {
+        // The TXT data is unchanged (and was validated when first
+        // stored); skip the allocation, copy, and re-validation.
+        mIsDeleted = false;
+        ExitNow();
+    }
 
     txtData = static_cast<uint8_t *>(Instance::HeapCAlloc(1, aLength));
     VerifyOrExit(txtData != nullptr, error = kErrorNoBufs);
@@ -1636,9 +1651,9 @@ Error Server::Host::AddIp6Address(const Ip6::Address &aIp6Address)
         ExitNow(error = kErrorDrop);
     }
 
-    for (const Ip6::Address &addr : mAddresses)
+    for (uint8_t index = 0; index < mAddressesNum; index++)
     {
-        if (aIp6Address == addr)
+        if (aIp6Address == mAddresses[index])
         {
             // Drop duplicate addresses.
             ExitNow(error = kErrorDrop);
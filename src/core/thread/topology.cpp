@@ -475,7 +475,9 @@ void Child::SetAddressMlrState(const Ip6::Address &aAddress, MlrState aState)
 
 void Router::Info::SetFrom(const Router &aRouter)
 {
-    Clear();
+    // All `otRouterInfo` members are explicitly set below, so there is
+    // no need to `Clear()` the struct first.
+
     mRloc16          = aRouter.GetRloc16();
     mRouterId        = Mle::Mle::RouterIdFromRloc16(mRloc16);
     mExtAddress      = aRouter.GetExtAddress();
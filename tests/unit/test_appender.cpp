@@ -0,0 +1,308 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/appender.hpp"
+#include "common/debug.hpp"
+#include "common/instance.hpp"
+#include "common/message.hpp"
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+namespace ot {
+
+void TestAppender(void)
+{
+    const uint8_t kData1[] = {0x01, 0x02, 0x03, 0x04};
+    const uint8_t kData2[] = {0xaa, 0xbb};
+
+    static constexpr uint16_t kMaxBufferSize =
+        sizeof(kData1) + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(kData2);
+
+    Instance *instance;
+    Message * message;
+    uint8_t   buffer[kMaxBufferSize];
+    uint8_t   zeroBuffer[kMaxBufferSize];
+    Appender  bufAppender(buffer, sizeof(buffer));
+    uint8_t   u8  = 0x42;
+    uint32_t  u32 = 0x12345678;
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    memset(buffer, 0, sizeof(buffer));
+    memset(zeroBuffer, 0, sizeof(zeroBuffer));
+
+    // Test `Appender` in `kBuffer` mode.
+
+    VerifyOrQuit(bufAppender.GetType() == Appender::kBuffer, "Appender::GetType() failed");
+    VerifyOrQuit(bufAppender.GetBufferStart() == buffer, "Appender::GetBufferStart() failed");
+    VerifyOrQuit(bufAppender.GetAppendedLength() == 0, "Appender::GetAppendedLength() failed");
+
+    SuccessOrQuit(bufAppender.AppendBytes(kData1, sizeof(kData1)), "Appender::AppendBytes() failed");
+    VerifyOrQuit(bufAppender.GetAppendedLength() == sizeof(kData1), "Appender::GetAppendedLength() failed");
+    VerifyOrQuit(memcmp(buffer, kData1, sizeof(kData1)) == 0, "Appender content is incorrect");
+
+    SuccessOrQuit(bufAppender.Append(u8), "Appender::Append() failed");
+    SuccessOrQuit(bufAppender.Append(u32), "Appender::Append() failed");
+    VerifyOrQuit(bufAppender.GetAppendedLength() == sizeof(kData1) + sizeof(u8) + sizeof(u32),
+                 "Appender::GetAppendedLength() failed");
+    VerifyOrQuit(memcmp(&buffer[sizeof(kData1)], &u8, sizeof(u8)) == 0, "Appender content is incorrect");
+    VerifyOrQuit(memcmp(&buffer[sizeof(kData1) + sizeof(u8)], &u32, sizeof(u32)) == 0, "Appender content is incorrect");
+
+    // Verify that appending beyond the buffer size fails and does not
+    // change the appended content.
+
+    VerifyOrQuit(bufAppender.AppendBytes(kData1, sizeof(kData1)) == kErrorNoBufs,
+                 "Appender::AppendBytes() did not fail with full buffer");
+    VerifyOrQuit(bufAppender.Append(u32) == kErrorNoBufs, "Appender::Append() did not fail with full buffer");
+    VerifyOrQuit(bufAppender.GetAppendedLength() == sizeof(kData1) + sizeof(u8) + sizeof(u32),
+                 "Appender::GetAppendedLength() failed");
+
+    SuccessOrQuit(bufAppender.AppendBytes(kData2, sizeof(kData2)), "Appender::AppendBytes() failed");
+    VerifyOrQuit(bufAppender.GetAppendedLength() == kMaxBufferSize, "Appender::GetAppendedLength() failed");
+    VerifyOrQuit(bufAppender.Append(u8) == kErrorNoBufs, "Appender::Append() did not fail with full buffer");
+
+    // Test `Appender` in `kMessage` mode.
+
+    message = instance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+    VerifyOrQuit(message != nullptr, "Message::New() failed");
+
+    SuccessOrQuit(message->AppendBytes(kData2, sizeof(kData2)), "Message::AppendBytes() failed");
+
+    {
+        Appender msgAppender(*message);
+        uint8_t  readBuffer[kMaxBufferSize];
+
+        VerifyOrQuit(msgAppender.GetType() == Appender::kMessage, "Appender::GetType() failed");
+        VerifyOrQuit(&msgAppender.GetMessage() == message, "Appender::GetMessage() failed");
+        VerifyOrQuit(msgAppender.GetAppendedLength() == 0, "Appender::GetAppendedLength() failed");
+
+        SuccessOrQuit(msgAppender.AppendBytes(kData1, sizeof(kData1)), "Appender::AppendBytes() failed");
+        SuccessOrQuit(msgAppender.Append(u8), "Appender::Append() failed");
+        SuccessOrQuit(msgAppender.Append(u32), "Appender::Append() failed");
+
+        VerifyOrQuit(msgAppender.GetAppendedLength() == sizeof(kData1) + sizeof(u8) + sizeof(u32),
+                     "Appender::GetAppendedLength() failed");
+        VerifyOrQuit(message->GetLength() == sizeof(kData2) + msgAppender.GetAppendedLength(),
+                     "Message::GetLength() failed");
+
+        SuccessOrQuit(message->Read(sizeof(kData2), readBuffer, sizeof(kData1)), "Message::Read() failed");
+        VerifyOrQuit(memcmp(readBuffer, kData1, sizeof(kData1)) == 0, "Appender content is incorrect");
+        SuccessOrQuit(message->Read(sizeof(kData2) + sizeof(kData1) + sizeof(u8), readBuffer, sizeof(u32)),
+                      "Message::Read() failed");
+        VerifyOrQuit(memcmp(readBuffer, &u32, sizeof(u32)) == 0, "Appender content is incorrect");
+    }
+
+    // Test `AppendItems()`.
+
+    {
+        const uint16_t kItems[] = {0x1122, 0x3344, 0x5566};
+
+        uint8_t  itemsBuffer[sizeof(kItems)];
+        Appender itemsAppender(itemsBuffer, sizeof(itemsBuffer));
+
+        SuccessOrQuit(itemsAppender.AppendItems(kItems, 3), "Appender::AppendItems() failed");
+        VerifyOrQuit(itemsAppender.GetAppendedLength() == sizeof(kItems), "GetAppendedLength() failed");
+        VerifyOrQuit(memcmp(itemsBuffer, kItems, sizeof(kItems)) == 0, "AppendItems() content is incorrect");
+        VerifyOrQuit(itemsAppender.AppendItems(kItems, 1) == kErrorNoBufs,
+                     "Appender::AppendItems() did not fail when full");
+    }
+
+    // Test `AppendBytesFromMessage()` in both modes.
+
+    {
+        uint8_t        fromMsgBuffer[sizeof(kData1)];
+        Appender       fromMsgAppender(fromMsgBuffer, sizeof(fromMsgBuffer));
+        Message *      message2;
+
+        message2 = instance->Get<MessagePool>().New(Message::kTypeIp6, 0);
+        VerifyOrQuit(message2 != nullptr, "Message::New() failed");
+        SuccessOrQuit(message2->AppendBytes(kData1, sizeof(kData1)), "Message::AppendBytes() failed");
+
+        SuccessOrQuit(fromMsgAppender.AppendBytesFromMessage(*message2, 0, sizeof(kData1)),
+                      "Appender::AppendBytesFromMessage() failed");
+        VerifyOrQuit(memcmp(fromMsgBuffer, kData1, sizeof(kData1)) == 0,
+                     "AppendBytesFromMessage() content is incorrect");
+        VerifyOrQuit(fromMsgAppender.AppendBytesFromMessage(*message2, 0, 1) == kErrorNoBufs,
+                     "AppendBytesFromMessage() did not fail when full");
+
+        {
+            Appender toMsgAppender(*message);
+            uint16_t oldLength = message->GetLength();
+
+            VerifyOrQuit(toMsgAppender.AppendBytesFromMessage(*message2, 2, sizeof(kData1)) == kErrorParse,
+                         "AppendBytesFromMessage() did not fail with short source");
+            SuccessOrQuit(toMsgAppender.AppendBytesFromMessage(*message2, 1, sizeof(kData1) - 1),
+                          "Appender::AppendBytesFromMessage() failed");
+            VerifyOrQuit(message->CompareBytes(oldLength, &kData1[1], sizeof(kData1) - 1),
+                         "AppendBytesFromMessage() content is incorrect");
+        }
+
+        message2->Free();
+    }
+
+    // Test `BufferAppender` and `MessageAppender` used directly.
+
+    {
+        uint8_t        smallBuffer[sizeof(u32)];
+        BufferAppender directBufAppender(smallBuffer, sizeof(smallBuffer));
+
+        SuccessOrQuit(directBufAppender.Append(u32), "BufferAppender::Append() failed");
+        VerifyOrQuit(directBufAppender.GetAppendedLength() == sizeof(u32), "BufferAppender::GetAppendedLength failed");
+        VerifyOrQuit(memcmp(smallBuffer, &u32, sizeof(u32)) == 0, "BufferAppender content is incorrect");
+        VerifyOrQuit(directBufAppender.Append(u8) == kErrorNoBufs, "BufferAppender::Append() did not fail when full");
+    }
+
+    {
+        uint8_t        reserveBuffer[sizeof(kData1) + sizeof(kData2)];
+        BufferAppender reserveAppender(reserveBuffer, sizeof(reserveBuffer));
+        uint8_t *      reserved;
+
+        SuccessOrQuit(reserveAppender.ReserveBytes(sizeof(kData1), reserved), "BufferAppender::ReserveBytes() failed");
+        VerifyOrQuit(reserved == reserveBuffer, "ReserveBytes() returned incorrect pointer");
+        VerifyOrQuit(reserveAppender.GetAppendedLength() == sizeof(kData1),
+                     "GetAppendedLength() after ReserveBytes() failed");
+
+        memcpy(reserved, kData1, sizeof(kData1));
+        SuccessOrQuit(reserveAppender.AppendBytes(kData2, sizeof(kData2)), "BufferAppender::AppendBytes() failed");
+        VerifyOrQuit(memcmp(reserveBuffer, kData1, sizeof(kData1)) == 0, "ReserveBytes() content is incorrect");
+        VerifyOrQuit(memcmp(&reserveBuffer[sizeof(kData1)], kData2, sizeof(kData2)) == 0,
+                     "ReserveBytes() content is incorrect");
+        VerifyOrQuit(reserveAppender.ReserveBytes(1, reserved) == kErrorNoBufs,
+                     "ReserveBytes() did not fail when full");
+    }
+
+    {
+        uint8_t        cursorBuffer[sizeof(kData1) + sizeof(u8) + sizeof(u32)];
+        BufferAppender cursorAppender(cursorBuffer, sizeof(cursorBuffer));
+
+        {
+            BufferAppender::Cursor cursor(cursorAppender);
+
+            SuccessOrQuit(cursor.AppendBytes(kData1, sizeof(kData1)), "Cursor::AppendBytes() failed");
+            SuccessOrQuit(cursor.Append(u8), "Cursor::Append() failed");
+            SuccessOrQuit(cursor.Append(u32), "Cursor::Append() failed");
+            VerifyOrQuit(cursor.Append(u8) == kErrorNoBufs, "Cursor::Append() did not fail when full");
+        }
+
+        VerifyOrQuit(cursorAppender.GetAppendedLength() == sizeof(cursorBuffer),
+                     "BufferAppender::GetAppendedLength() after Cursor failed");
+        VerifyOrQuit(memcmp(cursorBuffer, kData1, sizeof(kData1)) == 0, "Cursor content is incorrect");
+        VerifyOrQuit(memcmp(&cursorBuffer[sizeof(kData1) + sizeof(u8)], &u32, sizeof(u32)) == 0,
+                     "Cursor content is incorrect");
+    }
+
+    {
+        FixedBufferAppender<sizeof(kData1)> fixedAppender;
+
+        SuccessOrQuit(fixedAppender.AppendBytes(kData1, sizeof(kData1)), "FixedBufferAppender::AppendBytes() failed");
+        VerifyOrQuit(fixedAppender.GetAppendedLength() == sizeof(kData1),
+                     "FixedBufferAppender::GetAppendedLength() failed");
+        VerifyOrQuit(memcmp(fixedAppender.GetBufferStart(), kData1, sizeof(kData1)) == 0,
+                     "FixedBufferAppender content is incorrect");
+        VerifyOrQuit(fixedAppender.Append(u8) == kErrorNoBufs,
+                     "FixedBufferAppender::Append() did not fail when full");
+    }
+
+    {
+        uint8_t  writeBuffer[sizeof(kData1) + sizeof(u32)];
+        Appender writeAppender(writeBuffer, sizeof(writeBuffer));
+        uint32_t newU32 = 0xbeefcafe;
+
+        SuccessOrQuit(writeAppender.AppendBytes(kData1, sizeof(kData1)), "Appender::AppendBytes() failed");
+        SuccessOrQuit(writeAppender.Append(u32), "Appender::Append() failed");
+
+        writeAppender.WriteBytes(0, kData2, sizeof(kData2));
+        VerifyOrQuit(memcmp(writeBuffer, kData2, sizeof(kData2)) == 0, "Appender::WriteBytes() content is incorrect");
+
+        writeAppender.Write(sizeof(kData1), newU32);
+        VerifyOrQuit(memcmp(&writeBuffer[sizeof(kData1)], &newU32, sizeof(newU32)) == 0,
+                     "Appender::Write() content is incorrect");
+        VerifyOrQuit(writeAppender.GetAppendedLength() == sizeof(writeBuffer),
+                     "Appender::GetAppendedLength() changed by Write()");
+    }
+
+    {
+        uint16_t oldLength = message->GetLength();
+        Appender msgWriteAppender(*message);
+
+        SuccessOrQuit(msgWriteAppender.AppendBytes(kData1, sizeof(kData1)), "Appender::AppendBytes() failed");
+        msgWriteAppender.WriteBytes(0, kData2, sizeof(kData2));
+        VerifyOrQuit(message->CompareBytes(oldLength, kData2, sizeof(kData2)),
+                     "Appender::WriteBytes() content is incorrect");
+        IgnoreError(message->SetLength(oldLength));
+    }
+
+    {
+        uint8_t  moveBuffer[sizeof(kData1)];
+        Appender moveAppender(moveBuffer, sizeof(moveBuffer));
+        uint16_t oldLength = message->GetLength();
+
+        SuccessOrQuit(moveAppender.AppendBytes(kData1, sizeof(kData1)), "Appender::AppendBytes() failed");
+        SuccessOrQuit(moveAppender.MoveToMessage(*message), "Appender::MoveToMessage() failed");
+        VerifyOrQuit(message->GetLength() == oldLength + sizeof(kData1), "MoveToMessage() message length is incorrect");
+        VerifyOrQuit(message->CompareBytes(oldLength, kData1, sizeof(kData1)),
+                     "MoveToMessage() content is incorrect");
+        IgnoreError(message->SetLength(oldLength));
+    }
+
+    {
+        uint16_t oldLength = message->GetLength();
+        Appender msgMoveAppender(*message);
+
+        SuccessOrQuit(msgMoveAppender.AppendBytes(kData2, sizeof(kData2)), "Appender::AppendBytes() failed");
+        SuccessOrQuit(msgMoveAppender.MoveToMessage(*message), "Appender::MoveToMessage() failed");
+        VerifyOrQuit(message->GetLength() == oldLength + sizeof(kData2),
+                     "MoveToMessage() should not change an in-message `Appender`");
+        IgnoreError(message->SetLength(oldLength));
+    }
+
+    {
+        MessageAppender directMsgAppender(*message);
+        uint16_t        oldLength = message->GetLength();
+
+        SuccessOrQuit(directMsgAppender.AppendBytes(kData1, sizeof(kData1)), "MessageAppender::AppendBytes() failed");
+        VerifyOrQuit(directMsgAppender.GetAppendedLength() == sizeof(kData1),
+                     "MessageAppender::GetAppendedLength() failed");
+        VerifyOrQuit(&directMsgAppender.GetMessage() == message, "MessageAppender::GetMessage() failed");
+        VerifyOrQuit(message->CompareBytes(oldLength, kData1, sizeof(kData1)), "MessageAppender content is incorrect");
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestAppender();
+    printf("All tests passed\n");
+    return 0;
+}
@@ -265,6 +265,23 @@ void TestDnsName(void)
                      "Name::CompareName() did not fail with incorrect name");
         VerifyOrQuit(offset == len, "Name::CompareName() returned incorrect offset");
 
+        // Compare the whole name with an uppercased copy of the expected
+        // name (name matching is case-insensitive).
+        strcpy(name, test.mExpectedReadName);
+
+        for (char *nameChar = name; *nameChar != '\0'; nameChar++)
+        {
+            if (('a' <= *nameChar) && (*nameChar <= 'z'))
+            {
+                *nameChar = static_cast<char>(*nameChar - 'a' + 'A');
+            }
+        }
+
+        offset = 0;
+        SuccessOrQuit(Dns::Name::CompareName(*message, offset, name),
+                      "Name::CompareName() failed with uppercased name");
+        VerifyOrQuit(offset == len, "Name::CompareName() returned incorrect offset");
+
         // Remove the terminating '.' in expected name and verify
         // that it can still be used by `CompareName()`.
         offset = 0;